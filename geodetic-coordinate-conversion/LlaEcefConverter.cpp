@@ -5,8 +5,9 @@
  *      Author: Lane Hale
  *
  * Description: This file contains the main program logic, LLA to ECEF coordinate
- *              conversions, velocity calculations, and linear interpolation to
- *              get velocities at arbitrary times.
+ *              conversions, velocity calculations, linear interpolation to
+ *              get velocities at arbitrary times, and resampling of the track
+ *              onto a uniform time grid.
  *
  *     Purpose: Personal coding challenge demonstrating precision math, 
  *              coordinate transformations, and modern C++ practices.
@@ -140,6 +141,178 @@ void getInterpolatedVelocity(
     std::cout << std::format("({}, {}, {}) m/s\n", velocity_x.str(30), velocity_y.str(30), velocity_z.str(30));
 }
 
+// ----------------------------------------------------------------------------- //
+// Function to Build a double precision ECEF track from positions and velocities //
+// ----------------------------------------------------------------------------- //
+EcefTrack buildEcefTrack(
+    const std::vector<EcefData>& ecef_data,
+    const std::vector<HighPrecisionFloat>& velocity_x_vector,
+    const std::vector<HighPrecisionFloat>& velocity_y_vector,
+    const std::vector<HighPrecisionFloat>& velocity_z_vector
+) {
+    EcefTrack track;
+    track.resize(ecef_data.size());
+
+    for (size_t i = 0; i < ecef_data.size(); ++i) {
+        track.time[i] = ecef_data[i].time.convert_to<double>();
+        track.x[i] = ecef_data[i].x.convert_to<double>();
+        track.y[i] = ecef_data[i].y.convert_to<double>();
+        track.z[i] = ecef_data[i].z.convert_to<double>();
+        track.velocity_x[i] = velocity_x_vector[i].convert_to<double>();
+        track.velocity_y[i] = velocity_y_vector[i].convert_to<double>();
+        track.velocity_z[i] = velocity_z_vector[i].convert_to<double>();
+    }
+
+    return track;
+}
+
+// ---------------------------------------------------------------------------- //
+// Function to Get the number of uniform grid samples in [start_time, end_time] //
+// ---------------------------------------------------------------------------- //
+size_t getResampleCount(double start_time, double end_time, double time_step) {
+    if (time_step <= 0.0 || end_time < start_time) {
+        return 0;
+    }
+
+    // NaN or infinite times or step, or more samples than size_t can count
+    const double steps = std::floor((end_time - start_time) / time_step);
+    if (!std::isfinite(steps) || steps >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+        return 0;
+    }
+
+    return static_cast<size_t>(steps) + 1;
+}
+
+// Index of the first grid sample at or after time, clamped to [0, sample_count]
+static size_t firstGridIndexAtOrAfter(
+    double time,
+    double start_time,
+    double time_step,
+    size_t sample_count
+) {
+    const double index = std::ceil((time - start_time) / time_step);
+
+    if (index <= 0.0) {
+        return 0;
+    }
+    if (index >= static_cast<double>(sample_count)) {
+        return sample_count;
+    }
+    return static_cast<size_t>(index);
+}
+
+// Fill one span of grid samples by linear interpolation from point a.
+// Branch-free loop (vectorized): the parameters are values, so nothing is
+// reloaded after each store, __restrict tells the compiler the output arrays
+// do not overlap, and a 32-bit integer index keeps the loop countable.
+// first_grid_index + j is an exact integer, so the times are exactly
+// start_time + k * time_step.
+static void interpolateSpan(
+    int sample_count,
+    double start_time,
+    double time_step,
+    double first_grid_index,
+    double t0,
+    double inverse_delta_T,
+    double x0, double y0, double z0,
+    double vx0, double vy0, double vz0,
+    double delta_x, double delta_y, double delta_z,
+    double delta_vx, double delta_vy, double delta_vz,
+    double* __restrict out_time,
+    double* __restrict out_x,
+    double* __restrict out_y,
+    double* __restrict out_z,
+    double* __restrict out_vx,
+    double* __restrict out_vy,
+    double* __restrict out_vz
+) {
+    for (int j = 0; j < sample_count; ++j) {
+        const double time = start_time + (first_grid_index + static_cast<double>(j)) * time_step;
+        const double alpha = (time - t0) * inverse_delta_T;
+
+        out_time[j] = time;
+        out_x[j] = x0 + alpha * delta_x;
+        out_y[j] = y0 + alpha * delta_y;
+        out_z[j] = z0 + alpha * delta_z;
+        out_vx[j] = vx0 + alpha * delta_vx;
+        out_vy[j] = vy0 + alpha * delta_vy;
+        out_vz[j] = vz0 + alpha * delta_vz;
+    }
+}
+
+// ------------------------------------------------------ //
+// Function to Resample an ECEF track onto a uniform grid //
+// ------------------------------------------------------ //
+void resampleTrack(
+    const EcefTrack& track,
+    double start_time,
+    double time_step,
+    EcefTrack& output
+) {
+    const size_t point_count = track.size();
+    const size_t sample_count = output.size();
+
+    if (point_count == 0 || sample_count == 0 || time_step <= 0.0) {
+        return;
+    }
+
+    // Span j covers the grid samples between track points j - 1 and j.
+    // Span 0 (before the first point) and span point_count (at or after the
+    // last point) hold the endpoint values. The grid ranges of the spans are
+    // disjoint, so every span can be filled independently.
+    std::vector<size_t> spans(point_count + 1);
+    std::iota(spans.begin(), spans.end(), size_t{ 0 });
+
+    std::for_each(std::execution::par, spans.begin(), spans.end(), [&](size_t span) {
+        const size_t k_begin = (span == 0) ? 0 :
+            firstGridIndexAtOrAfter(track.time[span - 1], start_time, time_step, sample_count);
+        const size_t k_end = (span == point_count) ? sample_count :
+            firstGridIndexAtOrAfter(track.time[span], start_time, time_step, sample_count);
+
+        if (k_begin >= k_end) {
+            return;
+        }
+
+        // Interpolate from point a to point b (a == b holds an endpoint)
+        const size_t a = (span == 0) ? 0 : span - 1;
+        const size_t b = (span == point_count) ? point_count - 1 : span;
+
+        const double t0 = track.time[a];
+        const double inverse_delta_T = (a == b) ? 0.0 : 1.0 / (track.time[b] - t0);
+
+        const double x0 = track.x[a];
+        const double y0 = track.y[a];
+        const double z0 = track.z[a];
+        const double vx0 = track.velocity_x[a];
+        const double vy0 = track.velocity_y[a];
+        const double vz0 = track.velocity_z[a];
+        const double delta_x = track.x[b] - x0;
+        const double delta_y = track.y[b] - y0;
+        const double delta_z = track.z[b] - z0;
+        const double delta_vx = track.velocity_x[b] - vx0;
+        const double delta_vy = track.velocity_y[b] - vy0;
+        const double delta_vz = track.velocity_z[b] - vz0;
+
+        interpolateSpan(
+            static_cast<int>(k_end - k_begin),
+            start_time,
+            time_step,
+            static_cast<double>(k_begin),
+            t0,
+            inverse_delta_T,
+            x0, y0, z0, vx0, vy0, vz0,
+            delta_x, delta_y, delta_z, delta_vx, delta_vy, delta_vz,
+            output.time.data() + k_begin,
+            output.x.data() + k_begin,
+            output.y.data() + k_begin,
+            output.z.data() + k_begin,
+            output.velocity_x.data() + k_begin,
+            output.velocity_y.data() + k_begin,
+            output.velocity_z.data() + k_begin
+        );
+    });
+}
+
 
 // ---------------------------------------------------------------- //
 //                                                                  //
@@ -195,6 +368,42 @@ int main()
         z_velocity_interpolator
     );
 
+    // Resample the whole track onto a uniform 1 Hz grid in one pass
+    EcefTrack ecef_track = buildEcefTrack(
+        ecef_data,
+        velocity_x_vector,
+        velocity_y_vector,
+        velocity_z_vector
+    );
+
+    const double start_time = std::ceil(ecef_track.time.front());
+    const double end_time = ecef_track.time.back();
+    const double time_step = 1.0;
+
+    EcefTrack resampled_track;
+    resampled_track.resize(getResampleCount(start_time, end_time, time_step));
+
+    resampleTrack(ecef_track, start_time, time_step, resampled_track);
+
+    std::cout << std::format("\nResampled {} samples at {} s intervals starting at time {}\n",
+        resampled_track.size(), time_step, start_time);
+
+    // Look up the second target time on the grid (nearest sample)
+    const double target_time = target_time_2.convert_to<double>();
+
+    if (target_time >= start_time) {
+        const size_t grid_index = static_cast<size_t>(std::llround((target_time - start_time) / time_step));
+
+        if (grid_index < resampled_track.size()) {
+            std::cout << std::format("ECEF Velocity Vector (Vx, Vy, Vz) at time {} from the grid:\n",
+                resampled_track.time[grid_index]);
+            std::cout << std::format("({:.6f}, {:.6f}, {:.6f}) m/s\n",
+                resampled_track.velocity_x[grid_index],
+                resampled_track.velocity_y[grid_index],
+                resampled_track.velocity_z[grid_index]);
+        }
+    }
+
     return 0;
 }
 
@@ -7,7 +7,8 @@
  * Description: Header file containing constants, structures, and function 
  *              declarations for converting Latitude/Longitude/Altitude (LLA) 
  *              to Earth-Centered Earth-Fixed (ECEF) coordinates, including 
- *              velocity interpolation at arbitrary times.
+ *              velocity interpolation at arbitrary times and resampling of
+ *              the track onto a uniform time grid.
  *
  *     Purpose: Personal coding challenge demonstrating precision math, 
  *              coordinate transformations, and modern C++ practices.
@@ -15,10 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <execution>
 #include <format>
 #include <iostream>
 #include <cmath>
 #include <fstream>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -62,6 +67,33 @@ struct EcefData
 	HighPrecisionFloat z;    // Axis through the North Pole
 };
 
+// ECEF track stored as parallel arrays of doubles (one entry per sample) so
+// the resampling loops can be vectorized. Used for both the source track and
+// the preallocated uniform grid it is resampled onto.
+struct EcefTrack
+{
+	std::vector<double> time;
+	std::vector<double> x;
+	std::vector<double> y;
+	std::vector<double> z;
+	std::vector<double> velocity_x;
+	std::vector<double> velocity_y;
+	std::vector<double> velocity_z;
+
+	std::size_t size() const { return time.size(); }
+
+	void resize(std::size_t sample_count)
+	{
+		time.resize(sample_count);
+		x.resize(sample_count);
+		y.resize(sample_count);
+		z.resize(sample_count);
+		velocity_x.resize(sample_count);
+		velocity_y.resize(sample_count);
+		velocity_z.resize(sample_count);
+	}
+};
+
 // Function to Get LLA Data from a CSV file
 std::vector<LlaData> getLlaData(const std::string& filename);
 
@@ -85,3 +117,25 @@ void getInterpolatedVelocity(
 	const VelocityInterpolator& z_velocity_interpolator
 );
 
+// Function to Build a double precision ECEF track from positions and velocities
+EcefTrack buildEcefTrack(
+	const std::vector<EcefData>& ecef_data,
+	const std::vector<HighPrecisionFloat>& velocity_x_vector,
+	const std::vector<HighPrecisionFloat>& velocity_y_vector,
+	const std::vector<HighPrecisionFloat>& velocity_z_vector
+);
+
+// Function to Get the number of uniform grid samples in [start_time, end_time]
+std::size_t getResampleCount(double start_time, double end_time, double time_step);
+
+// Function to Resample an ECEF track onto a uniform time grid.
+// Fills every sample of the preallocated output track (output.size() samples
+// at start_time + k * time_step) with linearly interpolated position and
+// velocity. Samples outside the track's time span hold the nearest endpoint.
+void resampleTrack(
+	const EcefTrack& track,
+	double start_time,
+	double time_step,
+	EcefTrack& output
+);
+
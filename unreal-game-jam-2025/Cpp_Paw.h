@@ -9,6 +9,7 @@
  * Description: This header file defines the ACpp_Paw class, which
  *              includes variables and function declarations for
  *              controlling paw behavior and movement in the game.
+ *              The movement and pounce logic lives in PawSimulation.
  *        Note: UPROPERTY variables can be altered in Unreal Engine.
  *              Set the global Tick value to 30 FPS in Unreal Engine.
  *
@@ -19,6 +20,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "PawSimulation.h"
 #include "Cpp_Paw.generated.h"
 
 UCLASS()
@@ -40,11 +42,11 @@ public:
 
 	float getMoveToLoc1();
 
-	float updatePawMovement(float moveToLoc, float DeltaTime);
-
 private:
-	int m;
-	int pounceCount;
+	// Copy the UPROPERTY values into the simulation settings
+	PawSettings getPawSettings() const;
+
+	PawSimulation pawSimulation;
 
 	UPROPERTY(EditDefaultsOnly)
 	int leftRightWidth;
@@ -53,7 +55,6 @@ private:
 	int speedLeftRightPerTickLow;
 	UPROPERTY(EditDefaultsOnly)
 	int speedLeftRightPerTickHigh;
-	int speedLeftRightHigh;
 
 	UPROPERTY(EditDefaultsOnly)
 	float LeftRightPawRotationPerTick;
@@ -63,20 +64,12 @@ private:
 
 	UPROPERTY(EditDefaultsOnly)
 	int secondsBeforePounceHigh;
-	int secondsBeforePounceHi;
-
-	int secondsBeforePounce;
 
 	UPROPERTY(EditDefaultsOnly)
 	float delayPounceSecondsLow;
 	UPROPERTY(EditDefaultsOnly)
 	float delayPounceSecondsHigh;
 
-	int delayPounceSeedLow;
-	int delayPounceSeedHigh;
-
-	float delayBeforePounce;
-
 	UPROPERTY(EditDefaultsOnly)
 	float speedPounce;
 
@@ -96,32 +89,7 @@ private:
 	int fastDelayEachN_PouncesLow;
 	UPROPERTY(EditDefaultsOnly, Category = "Cpp Paw Difficulty")
 	int fastDelayEachN_PouncesHigh;
-	int fastDelayEachN_PouncesHi;
-	int fastDelayEachN_Pounces;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Cpp Paw Difficulty")
 	float fastDelayTimeSeconds;
-
-	float moveToLoc1;
-	float totalDistance;
-	float currentDistance;
-	float seconds;
-	float dotProduct;
-	float angleDegrees;
-	float rotatePawBy;
-
-	bool setLeftRightPawRotation;
-	bool decreasePawRotation;
-	bool pounced;
-	bool angleChecked;
-
-	FVector bubbleLoc;
-	FVector pawLocation;
-	FVector pawStartLoc;
-	FVector pawVertical;
-	FVector movedLoc;
-	FVector direction;
-	FVector direction2;
-
-	FRotator pawRotation;
 };
@@ -0,0 +1,275 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawCrowdSimulation.cpp
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: This file implements the batch update of many paws. Each
+ *              tick runs two loops over a block of paws: a branch-free
+ *              loop that moves every paw that is not pouncing back and
+ *              forth, then a scalar loop for the few paws that are
+ *              pouncing, stepped by the same updatePawPounce as PawSimulation.
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#include "PawCrowdSimulation.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <execution>
+
+// Keep walkPaws out of line: when it is inlined GCC loses the __restrict
+// guarantees and no longer vectorizes the loop
+#if defined(_MSC_VER)
+#define PAW_NOINLINE __declspec(noinline)
+#else
+#define PAW_NOINLINE __attribute__((noinline))
+#endif
+
+namespace
+{
+	// Seeds seed, seed + 1, ... for pawCount paws
+	std::vector<std::uint32_t> consecutiveSeeds(std::size_t pawCount, std::uint32_t seed)
+	{
+		std::vector<std::uint32_t> seeds(pawCount);
+		for (std::size_t paw = 0; paw < pawCount; ++paw)
+		{
+			seeds[paw] = seed + static_cast<std::uint32_t>(paw);
+		}
+		return seeds;
+	}
+
+	// Pick a when condition is 1 and b when it is 0. The choice is made with
+	// bit masks instead of ?: so the compiler cannot turn it back into a branch,
+	// which keeps walkPaws vectorized on baseline x86-64 (SSE2)
+	inline float select(std::uint32_t condition, float a, float b)
+	{
+		const std::uint32_t mask = 0u - condition;
+		return std::bit_cast<float>((std::bit_cast<std::uint32_t>(a) & mask) | (std::bit_cast<std::uint32_t>(b) & ~mask));
+	}
+
+	inline std::uint32_t select(std::uint32_t condition, std::uint32_t a, std::uint32_t b)
+	{
+		const std::uint32_t mask = 0u - condition;
+		return (a & mask) | (b & ~mask);
+	}
+
+	// Move every paw that is not pouncing back and forth (arrays start at the
+	// first paw of the block). Every paw computes the move and keeps it only if
+	// it is not pouncing, so the loop has no branches and can be vectorized.
+	// __restrict tells the compiler the arrays do not overlap.
+	PAW_NOINLINE void walkPaws(
+		std::size_t count,
+		float DeltaTime,
+		const int* __restrict leftRightWidth,
+		const int* __restrict speedLeftRightHigh,
+		const float* __restrict rotationPerTick,
+		const std::uint32_t* __restrict keys,
+		std::uint32_t* __restrict counters,
+		float* __restrict seconds,
+		const int* __restrict secondsBeforePounce,
+		const int* __restrict speedLeftRightPerTickLow,
+		float* __restrict locationX,
+		float* __restrict locationY,
+		float* __restrict moveToLoc,
+		float* __restrict pitch,
+		std::uint32_t* __restrict setLeftRightPawRotation,
+		std::uint32_t* __restrict decreasePawRotation)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			// Conditions are kept as 0/1 integers the same width as the data,
+			// so every choice below is a select on 32-bit lanes
+			const float secondsNow = seconds[i] + DeltaTime;
+			seconds[i] = secondsNow;
+
+			const std::uint32_t walking = secondsNow < static_cast<float>(secondsBeforePounce[i]);
+
+			// One random draw per tick: either a step or a new location to move to
+			const std::uint32_t randomBits = PawRandom::bits(keys[i], counters[i]);
+			counters[i] += walking;
+
+			const float x = locationX[i];
+			const float target = moveToLoc[i];
+			const std::uint32_t movingRight = target > 0;
+			const std::uint32_t needsStep = select(movingRight, std::uint32_t(x < target), std::uint32_t(x > target));
+
+			// random number 5 to 15
+			const float step = static_cast<float>(PawRandom::inRange(speedLeftRightPerTickLow[i], speedLeftRightHigh[i], randomBits));
+			// random number -975 to 975
+			const float newTarget = static_cast<float>(PawRandom::inRange(0, leftRightWidth[i], randomBits)) - (leftRightWidth[i] / 2.0f);
+
+			const float steppedX = select(needsStep, select(movingRight, x + step, x - step), x);
+			const float movedTarget = select(needsStep, target, newTarget);
+
+			// Start rotating on the first step in a new direction
+			const std::uint32_t firstStep = needsStep & (setLeftRightPawRotation[i] ^ 1u);
+			const float currentPitch = pitch[i];
+			const float startPitch = select(firstStep, select(movingRight, 20.f, -20.f), currentPitch);
+			const std::uint32_t decrease = select(firstStep, movingRight, decreasePawRotation[i]);
+
+			// Rotate paw back and forth
+			const std::uint32_t canDecrease = startPitch > -21.f;
+			const std::uint32_t canIncrease = startPitch < 21.f;
+			const float rotatedPitch = select(decrease, select(canDecrease, startPitch - rotationPerTick[i], startPitch),
+												select(canIncrease, startPitch + rotationPerTick[i], startPitch));
+			const std::uint32_t decreaseNext = select(decrease, canDecrease, canIncrease ^ 1u);
+
+			locationX[i] = select(walking, steppedX, x);
+			locationY[i] = select(walking, 0.f, locationY[i]);
+			moveToLoc[i] = select(walking, movedTarget, target);
+			pitch[i] = select(walking, rotatedPitch, currentPitch);
+			setLeftRightPawRotation[i] |= walking & firstStep;
+			decreasePawRotation[i] = select(walking, decreaseNext, decreasePawRotation[i]);
+		}
+	}
+}
+
+// Every paw uses the same settings, paw i gets seed + i
+PawCrowdSimulation::PawCrowdSimulation(const PawSettings& settings, std::size_t pawCount, std::uint32_t seed)
+	: PawCrowdSimulation(std::vector<PawSettings>{ settings }, std::vector<std::uint32_t>(pawCount, 0), consecutiveSeeds(pawCount, seed))
+{
+}
+
+// Set starting values for every paw from its settings
+PawCrowdSimulation::PawCrowdSimulation(const std::vector<PawSettings>& settings, const std::vector<std::uint32_t>& pawSettingsIndex,
+	const std::vector<std::uint32_t>& seeds)
+	: settingsIndex(pawSettingsIndex)
+{
+	// One seed per paw, and every paw uses an entry of the settings table
+	assert(seeds.size() == pawSettingsIndex.size() && "PawCrowdSimulation: one seed per paw");
+	assert(std::all_of(pawSettingsIndex.begin(), pawSettingsIndex.end(),
+		[&settings](std::uint32_t index) { return index < settings.size(); }) && "PawCrowdSimulation: settings index out of range");
+
+	for (const PawSettings& pawSettings : settings)
+	{
+		settingsTable.emplace_back(pawSettings);
+	}
+
+	const std::size_t pawCount = pawSettingsIndex.size();
+
+	leftRightWidth.resize(pawCount);
+	speedLeftRightHigh.resize(pawCount);
+	LeftRightPawRotationPerTick.resize(pawCount);
+
+	randomKey = seeds;
+	randomCounter.assign(pawCount, 0);
+
+	locationX.assign(pawCount, 0.f);
+	locationY.assign(pawCount, 0.f);
+	locationZ.assign(pawCount, 0.f);
+	pitch.assign(pawCount, 0.f);
+	seconds.assign(pawCount, 0.f);
+	moveToLoc.resize(pawCount);
+
+	speedLeftRightPerTickLow.resize(pawCount);
+	secondsBeforePounce.resize(pawCount);
+
+	setLeftRightPawRotation.assign(pawCount, 0);
+	decreasePawRotation.assign(pawCount, 0);
+
+	pounces.resize(pawCount);
+
+	for (std::size_t paw = 0; paw < pawCount; ++paw)
+	{
+		const PawSettings& pawSettings = settings[pawSettingsIndex[paw]];
+		const PawPounceSettings& pounceSettings = settingsTable[pawSettingsIndex[paw]];
+
+		leftRightWidth[paw] = pawSettings.leftRightWidth;
+		speedLeftRightHigh[paw] = pawSettings.speedLeftRightPerTickHigh - pawSettings.speedLeftRightPerTickLow;
+		LeftRightPawRotationPerTick[paw] = pawSettings.LeftRightPawRotationPerTick;
+		speedLeftRightPerTickLow[paw] = pawSettings.speedLeftRightPerTickLow;
+		pounces[paw].speedPounce = pawSettings.speedPounce;
+
+		// Same draws in the same order as the PawSimulation constructor
+		// random number -975 to 975
+		moveToLoc[paw] = static_cast<float>(PawRandom::inRange(0, leftRightWidth[paw], nextRandomBits(paw))) - (leftRightWidth[paw] / 2.0f);
+		// random number 2 to 6
+		secondsBeforePounce[paw] = PawRandom::inRange(pounceSettings.secondsBeforePounceLow, pounceSettings.secondsBeforePounceHi, nextRandomBits(paw));
+		// random number 6 to 9
+		pounces[paw].fastDelayEachN_Pounces = PawRandom::inRange(pounceSettings.fastDelayEachN_PouncesLow, pounceSettings.fastDelayEachN_PouncesHi, nextRandomBits(paw));
+	}
+
+	for (std::size_t begin = 0; begin < pawCount; begin += kBlockSize)
+	{
+		blockStarts.push_back(begin);
+	}
+
+}
+
+void PawCrowdSimulation::setLocation(std::size_t paw, const PawVector& location)
+{
+	locationX[paw] = location.X;
+	locationY[paw] = location.Y;
+	locationZ[paw] = location.Z;
+
+}
+
+template <typename BubbleAt>
+void PawCrowdSimulation::tickBlock(std::size_t begin, std::size_t end, float DeltaTime, const BubbleAt& bubbleAt)
+{
+	// Paw moves to random location on right or left until time before pouncing is up
+	walkPaws(end - begin, DeltaTime, leftRightWidth.data() + begin, speedLeftRightHigh.data() + begin,
+		LeftRightPawRotationPerTick.data() + begin,
+		randomKey.data() + begin, randomCounter.data() + begin, seconds.data() + begin,
+		secondsBeforePounce.data() + begin, speedLeftRightPerTickLow.data() + begin,
+		locationX.data() + begin, locationY.data() + begin, moveToLoc.data() + begin, pitch.data() + begin,
+		setLeftRightPawRotation.data() + begin, decreasePawRotation.data() + begin);
+
+	// Is it time to pounce?
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		if (seconds[i] >= secondsBeforePounce[i])
+		{
+			updatePounce(i, DeltaTime, bubbleAt(i));
+		}
+	}
+
+}
+
+// Called every tick, blocks of paws are updated in parallel
+void PawCrowdSimulation::tick(float DeltaTime, const PawVector& bubbleLoc)
+{
+	const auto bubbleAt = [&bubbleLoc](std::size_t) -> const PawVector& { return bubbleLoc; };
+
+	std::for_each(std::execution::par, blockStarts.begin(), blockStarts.end(), [&](std::size_t begin) {
+		tickBlock(begin, std::min(begin + kBlockSize, size()), DeltaTime, bubbleAt);
+	});
+
+}
+
+void PawCrowdSimulation::tick(float DeltaTime, const std::vector<float>& bubbleX, const std::vector<float>& bubbleY,
+	const std::vector<float>& bubbleZ)
+{
+	// One bubble location per paw
+	assert(bubbleX.size() == size() && bubbleY.size() == size() && bubbleZ.size() == size()
+		&& "PawCrowdSimulation::tick: one bubble location per paw");
+
+	const auto bubbleAt = [&](std::size_t paw) { return PawVector{ bubbleX[paw], bubbleY[paw], bubbleZ[paw] }; };
+
+	std::for_each(std::execution::par, blockStarts.begin(), blockStarts.end(), [&](std::size_t begin) {
+		tickBlock(begin, std::min(begin + kBlockSize, size()), DeltaTime, bubbleAt);
+	});
+
+}
+
+// The pounce runs one paw at a time, so the paw's state is copied out of
+// the arrays, stepped by the same updatePawPounce as PawSimulation, and copied back
+void PawCrowdSimulation::updatePounce(std::size_t paw, float DeltaTime, const PawVector& bubbleLoc)
+{
+	PawRandom rng(randomKey[paw], randomCounter[paw]);
+	PawVector pawLocation = getLocation(paw);
+	bool setRotation = setLeftRightPawRotation[paw] != 0;
+
+	updatePawPounce(settingsTable[settingsIndex[paw]], pounces[paw], rng, DeltaTime, bubbleLoc, pawLocation, pitch[paw],
+		seconds[paw], secondsBeforePounce[paw], speedLeftRightPerTickLow[paw], setRotation);
+
+	randomCounter[paw] = rng.getCounter();
+	setLocation(paw, pawLocation);
+	setLeftRightPawRotation[paw] = setRotation ? 1u : 0u;
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawCrowdSimulation.h
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: This header file defines the PawCrowdSimulation class,
+ *              which steps thousands of paws at once. Paw state is kept
+ *              as a structure of arrays (one array per variable), so the
+ *              back and forth movement of every paw is updated in one
+ *              branch-free, vectorizable loop, and blocks of paws are
+ *              updated in parallel.
+ *              Every paw can have its own settings, seed and bubble, so
+ *              one crowd can also play many independent games at once.
+ *        Note: Paw i behaves exactly like PawSimulation(settings, seed + i),
+ *              since each paw has its own PawRandom stream.
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#pragma once
+
+#include "PawSimulation.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class PawCrowdSimulation
+{
+public:
+	PawCrowdSimulation(const PawSettings& settings, std::size_t pawCount, std::uint32_t seed = 1);
+
+	// Paw i uses settings[pawSettingsIndex[i]] and seeds[i], and behaves exactly
+	// like PawSimulation(settings[pawSettingsIndex[i]], seeds[i]).
+	// seeds must have one entry per paw and every index must be < settings.size() (asserted)
+	PawCrowdSimulation(const std::vector<PawSettings>& settings, const std::vector<std::uint32_t>& pawSettingsIndex,
+		const std::vector<std::uint32_t>& seeds);
+
+	// Advance every paw by one tick toward/away from the bubble's location
+	void tick(float DeltaTime, const PawVector& bubbleLoc);
+
+	// Advance every paw by one tick toward/away from its own bubble,
+	// paw i uses bubble location (bubbleX[i], bubbleY[i], bubbleZ[i]), all three have size() entries (asserted)
+	void tick(float DeltaTime, const std::vector<float>& bubbleX, const std::vector<float>& bubbleY,
+		const std::vector<float>& bubbleZ);
+
+	std::size_t size() const { return locationX.size(); }
+
+	void setLocation(std::size_t paw, const PawVector& location);
+
+	PawVector getLocation(std::size_t paw) const { return { locationX[paw], locationY[paw], locationZ[paw] }; }
+	float getPitch(std::size_t paw) const { return pitch[paw]; }
+	int getPounceCount(std::size_t paw) const { return pounces[paw].pounceCount; }
+
+	// True from the moment a pounce is set up until the paw has reset
+	bool isPouncing(std::size_t paw) const { return pounces[paw].pounced; }
+
+	// True once the delay is over and the paw is moving toward the bubble
+	bool isPounceMoving(std::size_t paw) const
+	{
+		return pounces[paw].pounced && seconds[paw] >= static_cast<float>(secondsBeforePounce[paw] + pounces[paw].delayBeforePounce);
+	}
+
+	// Location arrays for rendering, e.g. with an instanced static mesh
+	const std::vector<float>& getLocationsX() const { return locationX; }
+	const std::vector<float>& getLocationsY() const { return locationY; }
+	const std::vector<float>& getLocationsZ() const { return locationZ; }
+	const std::vector<float>& getPitches() const { return pitch; }
+
+private:
+	// Number of paws each parallel task updates
+	static constexpr std::size_t kBlockSize = 2048;
+
+	// bubbleAt(paw) gives the bubble location paw is moving toward/away from
+	template <typename BubbleAt>
+	void tickBlock(std::size_t begin, std::size_t end, float DeltaTime, const BubbleAt& bubbleAt);
+	void updatePounce(std::size_t paw, float DeltaTime, const PawVector& bubbleLoc);
+
+	std::uint32_t nextRandomBits(std::size_t paw) { return PawRandom::bits(randomKey[paw], randomCounter[paw]++); }
+
+	// Pounce settings of each entry of the settings table, and the entry each paw uses
+	std::vector<PawPounceSettings> settingsTable;
+	std::vector<std::uint32_t> settingsIndex;
+
+	// Walk settings copied per paw, so the walk loop reads them like the rest of the state
+	std::vector<int> leftRightWidth;
+	std::vector<int> speedLeftRightHigh;
+	std::vector<float> LeftRightPawRotationPerTick;
+
+	// Per paw state, one entry per paw
+	std::vector<std::uint32_t> randomKey;
+	std::vector<std::uint32_t> randomCounter;
+
+	std::vector<float> locationX;
+	std::vector<float> locationY;
+	std::vector<float> locationZ;
+	std::vector<float> pitch;
+	std::vector<float> seconds;
+	std::vector<float> moveToLoc;
+
+	std::vector<int> speedLeftRightPerTickLow;
+	std::vector<int> secondsBeforePounce;
+
+	std::vector<std::uint32_t> setLeftRightPawRotation;
+	std::vector<std::uint32_t> decreasePawRotation;
+
+	// Pounce state, only used while a paw is pouncing
+	std::vector<PawPounceState> pounces;
+
+	std::vector<std::size_t> blockStarts;
+};
@@ -0,0 +1,70 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawRandom.h
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: This header file defines PawRandom, a counter-based random
+ *              number generator used in place of rand(). Each number is a
+ *              hash of the paw's key (its seed) and a draw counter, so
+ *              every paw has its own reproducible stream, there is no
+ *              shared state between threads, and the hash can be
+ *              computed for many paws at once in a vectorized loop.
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class PawRandom
+{
+public:
+	explicit PawRandom(std::uint32_t seed = 1) : key(seed), counter(0) {}
+
+	// Continue the stream with this key from draw number drawCounter
+	PawRandom(std::uint32_t seed, std::uint32_t drawCounter) : key(seed), counter(drawCounter) {}
+
+	// Number of the next draw
+	std::uint32_t getCounter() const { return counter; }
+
+	// Random number low to low + range - 1, replaces low + (rand() % range)
+	int inRange(int low, int range)
+	{
+		return inRange(low, range, bits(key, counter++));
+	}
+
+	// 32 random bits for draw number counter of the stream with this key
+	static std::uint32_t bits(std::uint32_t key, std::uint32_t counter)
+	{
+		// The counter is hashed before the key is mixed in, so streams with
+		// different keys are unrelated instead of shifted copies of each other.
+		// Only 32-bit operations, so the hash vectorizes on baseline x86-64 (SSE2).
+		return hash(hash(counter) ^ key);
+	}
+
+	// 32-bit integer hash (lowbias32 by Chris Wellons)
+	static std::uint32_t hash(std::uint32_t x)
+	{
+		x ^= x >> 16;
+		x *= 0x7FEB352Du;
+		x ^= x >> 15;
+		x *= 0x846CA68Bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	// Map random bits to low to low + range - 1 (multiply-shift, no division or branches)
+	static int inRange(int low, int range, std::uint32_t randomBits)
+	{
+		const std::uint32_t positiveRange = static_cast<std::uint32_t>(range > 0 ? range : 0);
+		return low + static_cast<int>((static_cast<std::uint64_t>(randomBits) * positiveRange) >> 32);
+	}
+
+private:
+	std::uint32_t key;
+	std::uint32_t counter;
+};
@@ -0,0 +1,264 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawSimulation.cpp
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: This file implements the engine-agnostic paw movement and
+ *              pouncing mechanics moved out of ACpp_Paw, including
+ *              randomization of movement intervals and speeds.
+ *
+ *              The cat paw moves randomly back and forth at the top of
+ *              the fish tank. The paw pounces at random intervals to try
+ *              and pop the bubble to catch the fish inside it. Movements
+ *              and intervals speed up as the game progresses.
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#include "PawSimulation.h"
+
+// Work out the random ranges of the pounce settings
+PawPounceSettings::PawPounceSettings(const PawSettings& settings)
+{
+	secondsBeforePounceLow = settings.secondsBeforePounceLow;
+	secondsBeforePounceHi = settings.secondsBeforePounceHigh - secondsBeforePounceLow;
+
+	delayPounceSeedLow = static_cast<int>(settings.delayPounceSecondsLow * 100);
+	delayPounceSeedHigh = static_cast<int>(settings.delayPounceSecondsHigh * 100) - delayPounceSeedLow;
+
+	maxPawAngle = settings.maxPawAngle;
+
+	increaseSpeedsAfterN_Pounces = settings.increaseSpeedsAfterN_Pounces;
+	increaseLeftRightSpeedBy = settings.increaseLeftRightSpeedBy;
+	increasePounceSpeedBy = settings.increasePounceSpeedBy;
+
+	fastDelayTimeSeconds = settings.fastDelayTimeSeconds;
+	fastDelayEachN_PouncesLow = settings.fastDelayEachN_PouncesLow;
+	fastDelayEachN_PouncesHi = settings.fastDelayEachN_PouncesHigh - fastDelayEachN_PouncesLow;
+
+}
+
+// Set starting values from the settings
+PawSimulation::PawSimulation(const PawSettings& settings, std::uint32_t seed)
+	: rng(seed), pounceSettings(settings)
+{
+	leftRightWidth = settings.leftRightWidth;
+	// random number -975 to 975
+	moveToLoc = static_cast<float>(rng.inRange(0, leftRightWidth)) - (leftRightWidth / 2.0f);
+
+	LeftRightPawRotationPerTick = settings.LeftRightPawRotationPerTick;
+
+	speedLeftRightPerTickLow = settings.speedLeftRightPerTickLow;
+	speedLeftRightHigh = settings.speedLeftRightPerTickHigh - speedLeftRightPerTickLow;
+
+	// random number 2 to 6
+	secondsBeforePounce = rng.inRange(pounceSettings.secondsBeforePounceLow, pounceSettings.secondsBeforePounceHi);
+
+	pounce.speedPounce = settings.speedPounce;
+	// random number 6 to 9
+	pounce.fastDelayEachN_Pounces = rng.inRange(pounceSettings.fastDelayEachN_PouncesLow, pounceSettings.fastDelayEachN_PouncesHi);
+
+	seconds = 0.f;
+	setLeftRightPawRotation = false;
+	decreasePawRotation = false;
+	pawPitch = 0.f;
+
+}
+
+// Called every tick
+void PawSimulation::tick(float DeltaTime, const PawVector& bubbleLoc)
+{
+	seconds += DeltaTime;
+
+	// Is it time to pounce?
+	if (seconds >= secondsBeforePounce)
+	{
+		updatePawPounce(pounceSettings, pounce, rng, DeltaTime, bubbleLoc, pawLocation, pawPitch, seconds,
+			secondsBeforePounce, speedLeftRightPerTickLow, setLeftRightPawRotation);
+	}
+	else
+	{
+		updateLeftRight();
+	}
+
+}
+
+void updatePawPounce(const PawPounceSettings& settings, PawPounceState& pounce, PawRandom& rng,
+	float DeltaTime, const PawVector& bubbleLoc, PawVector& pawLocation, float& pawPitch, float& seconds,
+	int& secondsBeforePounce, int& speedLeftRightPerTickLow, bool& setLeftRightPawRotation)
+{
+	// Get working variables one time only before pouncing
+	if (pounce.pounced == false)
+	{
+		pounce.pounced = true;
+
+		pounce.direction = pawLocation - bubbleLoc;
+
+		pounce.totalDistance = pounce.direction.Size();
+		pounce.currentDistance = 0.f;
+
+		pounce.direction = pounce.direction.GetSafeNormal(); // get normal direction
+
+		pounce.pawStartLoc = pawLocation;
+		pounce.movedLoc = pawLocation;
+
+		if (pounce.pounceCount % pounce.fastDelayEachN_Pounces != 0)
+		{
+			// random number 30 to 75, made into .30 to .75
+			pounce.delayBeforePounce = static_cast<float>(rng.inRange(settings.delayPounceSeedLow, settings.delayPounceSeedHigh)) / 100.0f;
+		}
+		else
+		{
+			pounce.delayBeforePounce = settings.fastDelayTimeSeconds;
+			// random number 6 to 9
+			pounce.fastDelayEachN_Pounces = rng.inRange(settings.fastDelayEachN_PouncesLow, settings.fastDelayEachN_PouncesHi);
+		}
+
+		// Get vertical vector of pawLocation
+		PawVector pawVertical{ pawLocation.X, 0.f, bubbleLoc.Z };
+		// Get direction of vertical
+		PawVector direction2 = (pawLocation - pawVertical).GetSafeNormal();
+		// Get the dot product
+		float dotProduct = PawVector::DotProduct(pounce.direction, direction2);
+		// Get angle in radians, clamped like FMath::Acos
+		float angleInRadians = std::acos(std::fmax(-1.f, std::fmin(dotProduct, 1.f)));
+		// Convert radians to degrees
+		pounce.angleDegrees = angleInRadians * kRadiansToDegrees;
+
+		if (pounce.angleDegrees > settings.maxPawAngle)
+		{
+			pounce.angleDegrees = settings.maxPawAngle;
+		}
+
+		if (bubbleLoc.X < pounce.pawStartLoc.X)
+		{
+			pounce.angleDegrees *= -1;
+		}
+
+		// Compute how much to rotate paw during delay
+		// Divide distance to rotate by number of ticks during delay
+		pounce.rotatePawBy = std::fabs((pawPitch - pounce.angleDegrees) / (pounce.delayBeforePounce * 60));
+	}
+
+	// Stop moving paw and backup its location
+	if (seconds < static_cast<float>(secondsBeforePounce + pounce.delayBeforePounce))
+	{
+		pawLocation.Z += 5.f;
+
+		// rotate towards bubbleLoc
+		if (pawPitch < pounce.angleDegrees)
+		{
+			pawPitch += pounce.rotatePawBy;
+		}
+		else if (pawPitch > pounce.angleDegrees)
+		{
+			pawPitch -= pounce.rotatePawBy;
+		}
+	}
+	// Delay is over, we are pouncing now
+	else if (pounce.currentDistance < pounce.totalDistance)
+	{
+		// move incrementally to movedLoc
+		pounce.movedLoc -= pounce.direction * pounce.speedPounce * DeltaTime;
+
+		// update paw's location
+		pawLocation = pounce.movedLoc;
+
+		// update distance moved so far
+		pounce.currentDistance = (pounce.movedLoc - pounce.pawStartLoc).Size();
+	}
+	// Pounce is over, reset and try again if we missed the bubble
+	else
+	{
+		++pounce.pounceCount;
+		pawLocation = pounce.pawStartLoc;
+		pawPitch = 0.f;
+		pounce.pounced = false;
+		seconds = 0.f;
+		// random number 2 to 6
+		secondsBeforePounce = rng.inRange(settings.secondsBeforePounceLow, settings.secondsBeforePounceHi);
+		setLeftRightPawRotation = false;
+
+		if (pounce.pounceCount > settings.increaseSpeedsAfterN_Pounces)
+		{
+			pounce.speedPounce += settings.increasePounceSpeedBy;
+			speedLeftRightPerTickLow += settings.increaseLeftRightSpeedBy;
+		}
+	}
+
+}
+
+// Paw moves to random location on right or left until time before pouncing is up
+void PawSimulation::updateLeftRight()
+{
+	if (moveToLoc > 0)
+	{
+		if (pawLocation.X < moveToLoc)
+		{
+			// random number 5 to 15
+			pawLocation.X += static_cast<float>(rng.inRange(speedLeftRightPerTickLow, speedLeftRightHigh));
+
+			if (!setLeftRightPawRotation)
+			{
+				pawPitch = 20.f;
+				setLeftRightPawRotation = true;
+				decreasePawRotation = true;
+			}
+		}
+		else
+		{
+			// random number -975 to 975
+			moveToLoc = static_cast<float>(rng.inRange(0, leftRightWidth)) - (leftRightWidth / 2.0f);
+		}
+	}
+	else // moveToLoc <= 0
+	{
+		if (pawLocation.X > moveToLoc)
+		{
+			// random number 5 to 15
+			pawLocation.X -= static_cast<float>(rng.inRange(speedLeftRightPerTickLow, speedLeftRightHigh));
+
+			if (!setLeftRightPawRotation)
+			{
+				pawPitch = -20.f;
+				setLeftRightPawRotation = true;
+				decreasePawRotation = false;
+			}
+		}
+		else
+		{
+			// random number -975 to 975
+			moveToLoc = static_cast<float>(rng.inRange(0, leftRightWidth)) - (leftRightWidth / 2.0f);
+		}
+	}
+
+	// Rotate paw back and forth
+	if (decreasePawRotation)
+	{
+		if (pawPitch > -21.f)
+		{
+			pawPitch -= LeftRightPawRotationPerTick;
+		}
+		else
+		{
+			decreasePawRotation = false;
+		}
+	}
+	else
+	{
+		if (pawPitch < 21.f)
+		{
+			pawPitch += LeftRightPawRotationPerTick;
+		}
+		else
+		{
+			decreasePawRotation = true;
+		}
+	}
+
+	pawLocation.Y = 0.f;
+
+}
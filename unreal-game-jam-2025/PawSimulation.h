@@ -0,0 +1,183 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawSimulation.h
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: This header file defines the PawSimulation class, an
+ *              engine-agnostic version of the paw movement and pounce
+ *              state machine. It has no Unreal Engine dependencies, so
+ *              it can be driven by ACpp_Paw in the game or by the
+ *              headless batch simulator for difficulty balancing.
+ *        Note: All state is per instance, including the random number
+ *              generator, so paws do not share state and runs with the
+ *              same seed are reproducible.
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#pragma once
+
+#include "PawRandom.h"
+
+#include <cmath>
+#include <cstdint>
+
+// Same value as UE_RADS_TO_DEGREES (180 / pi)
+inline constexpr float kRadiansToDegrees = 57.2957795130823208768f;
+
+// Minimal 3D vector with the FVector operations the paw logic uses
+struct PawVector
+{
+	float X = 0.f;
+	float Y = 0.f;
+	float Z = 0.f;
+
+	PawVector operator+(const PawVector& other) const { return { X + other.X, Y + other.Y, Z + other.Z }; }
+	PawVector operator-(const PawVector& other) const { return { X - other.X, Y - other.Y, Z - other.Z }; }
+	PawVector operator*(float scale) const { return { X * scale, Y * scale, Z * scale }; }
+	PawVector& operator-=(const PawVector& other) { X -= other.X; Y -= other.Y; Z -= other.Z; return *this; }
+
+	float Size() const { return std::sqrt(X * X + Y * Y + Z * Z); }
+
+	// Same behavior as FVector::GetSafeNormal(), zero vector if too small
+	PawVector GetSafeNormal() const
+	{
+		const float squareSum = X * X + Y * Y + Z * Z;
+		if (squareSum < 1.e-8f)
+		{
+			return {};
+		}
+		const float scale = 1.f / std::sqrt(squareSum);
+		return { X * scale, Y * scale, Z * scale };
+	}
+
+	static float DotProduct(const PawVector& a, const PawVector& b) { return a.X * b.X + a.Y * b.Y + a.Z * b.Z; }
+};
+
+// Tunable paw settings (the UPROPERTY values of ACpp_Paw)
+struct PawSettings
+{
+	int leftRightWidth = 1950;
+
+	int speedLeftRightPerTickLow = 5;
+	int speedLeftRightPerTickHigh = 15;
+
+	float LeftRightPawRotationPerTick = 0.5f;
+
+	int secondsBeforePounceLow = 2;
+	int secondsBeforePounceHigh = 6;
+
+	float delayPounceSecondsLow = 0.30f;
+	float delayPounceSecondsHigh = 0.75f;
+
+	float speedPounce = 1000.0f;
+	float maxPawAngle = 80.0f;
+
+	int increaseSpeedsAfterN_Pounces = 2;
+	int increaseLeftRightSpeedBy = 3;
+	float increasePounceSpeedBy = 250.0f;
+
+	float fastDelayTimeSeconds = 0.15f;
+	int fastDelayEachN_PouncesLow = 6;
+	int fastDelayEachN_PouncesHigh = 9;
+};
+
+// Pounce settings with the random ranges worked out (low value and range size)
+struct PawPounceSettings
+{
+	explicit PawPounceSettings(const PawSettings& settings = PawSettings());
+
+	int secondsBeforePounceLow;
+	int secondsBeforePounceHi;
+	int delayPounceSeedLow;
+	int delayPounceSeedHigh;
+	float maxPawAngle;
+	int increaseSpeedsAfterN_Pounces;
+	float increasePounceSpeedBy;
+	int increaseLeftRightSpeedBy;
+	int fastDelayEachN_PouncesLow;
+	int fastDelayEachN_PouncesHi;
+	float fastDelayTimeSeconds;
+};
+
+// State of one paw that only the pounce uses
+struct PawPounceState
+{
+	bool pounced = false;
+	int pounceCount = 0;
+	int fastDelayEachN_Pounces = 0;
+	float speedPounce = 0.f;
+	float delayBeforePounce = 0.f;
+	float totalDistance = 0.f;
+	float currentDistance = 0.f;
+	float angleDegrees = 0.f;
+	float rotatePawBy = 0.f;
+	PawVector pawStartLoc;
+	PawVector movedLoc;
+	PawVector direction;
+};
+
+// Advance a pounce toward bubbleLoc by one tick: set it up, back the paw up
+// during the delay, move it, then reset the paw once the pounce is over.
+// The other arguments are the paw state shared with the back and forth movement.
+// Used by both PawSimulation and PawCrowdSimulation, so the pounce logic is in one place.
+void updatePawPounce(const PawPounceSettings& settings, PawPounceState& pounce, PawRandom& rng,
+	float DeltaTime, const PawVector& bubbleLoc, PawVector& pawLocation, float& pawPitch, float& seconds,
+	int& secondsBeforePounce, int& speedLeftRightPerTickLow, bool& setLeftRightPawRotation);
+
+class PawSimulation
+{
+public:
+	PawSimulation(const PawSettings& settings = PawSettings(), std::uint32_t seed = 1);
+
+	// Advance the paw by one tick toward/away from the bubble's location
+	void tick(float DeltaTime, const PawVector& bubbleLoc);
+
+	void setLocation(const PawVector& location) { pawLocation = location; }
+	void setPitch(float pitch) { pawPitch = pitch; }
+
+	const PawVector& getLocation() const { return pawLocation; }
+	float getPitch() const { return pawPitch; }
+	float getMoveToLoc() const { return moveToLoc; }
+	int getPounceCount() const { return pounce.pounceCount; }
+	float getSpeedPounce() const { return pounce.speedPounce; }
+
+	// True from the moment a pounce is set up until the paw has reset
+	bool isPouncing() const { return pounce.pounced; }
+
+	// True if the next tick sets up a pounce, the only time tick() reads the bubble's location
+	bool startsPounceNextTick(float DeltaTime) const { return !pounce.pounced && seconds + DeltaTime >= secondsBeforePounce; }
+
+	// True once the delay is over and the paw is moving toward the bubble
+	bool isPounceMoving() const { return pounce.pounced && seconds >= secondsBeforePounce + pounce.delayBeforePounce; }
+
+private:
+	void updateLeftRight();
+
+	PawRandom rng;
+
+	PawPounceSettings pounceSettings;
+	PawPounceState pounce;
+
+	int leftRightWidth;
+
+	int speedLeftRightPerTickLow;
+	int speedLeftRightHigh;
+
+	float LeftRightPawRotationPerTick;
+
+	int secondsBeforePounce;
+
+	float moveToLoc;
+	float seconds;
+
+	bool setLeftRightPawRotation;
+	bool decreasePawRotation;
+
+	PawVector pawLocation;
+
+	float pawPitch;
+};
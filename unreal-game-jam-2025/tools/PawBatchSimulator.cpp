@@ -0,0 +1,182 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawBatchSimulator.cpp
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: Headless driver that steps PawSimulation through many
+ *              simulated games without Unreal Engine, faster than real
+ *              time. It sweeps the difficulty settings and reports how
+ *              long a simple simulated player survives with each one.
+ *
+ *              Usage: PawBatchSimulator [gamesPerSetting] [seed]
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#include "PawSimulation.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	// Set the global Tick value to 30 FPS, same as in Unreal Engine
+	constexpr float kTickSeconds = 1.f / 30.f;
+	constexpr float kMaxGameSeconds = 300.f;
+
+	// Fish tank layout (Unreal units)
+	constexpr float kPawStartZ = 600.f;
+	constexpr float kTankHalfWidth = 975.f;
+	constexpr float kBubbleLowZ = -500.f;
+	constexpr float kBubbleHighZ = 300.f;
+
+	// Simulated player
+	constexpr float kBubbleSpeed = 200.f;       // wandering speed
+	constexpr float kBubbleDodgeSpeed = 450.f;  // speed when dodging a pounce
+	constexpr float kReactionSeconds = 0.25f;   // time before the player reacts to a pounce
+	constexpr float kCatchDistance = 120.f;     // paw touches bubble
+
+	struct GameResult
+	{
+		bool caught;
+		float seconds;
+		int pounces;
+	};
+
+	struct SweepResult
+	{
+		int gamesCaught = 0;
+		double totalSeconds = 0.0;
+		long long totalPounces = 0;
+	};
+
+	float clampFloat(float value, float low, float high)
+	{
+		return value < low ? low : (value > high ? high : value);
+	}
+
+	// Play one game until the paw catches the bubble or time runs out
+	GameResult playGame(const PawSettings& settings, std::uint32_t seed)
+	{
+		PawSimulation paw(settings, seed);
+		paw.setLocation(PawVector{ 0.f, 0.f, kPawStartZ });
+
+		std::minstd_rand playerRng(seed ^ 0x9E3779B9u);
+		std::uniform_real_distribution<float> randomX(-kTankHalfWidth, kTankHalfWidth);
+		std::uniform_real_distribution<float> randomZ(kBubbleLowZ, kBubbleHighZ);
+
+		PawVector bubbleLoc{ 0.f, 0.f, 0.f };
+		PawVector waypoint{ randomX(playerRng), 0.f, randomZ(playerRng) };
+		float pounceMovingSeconds = 0.f;
+
+		for (float seconds = 0.f; seconds < kMaxGameSeconds; seconds += kTickSeconds)
+		{
+			paw.tick(kTickSeconds, bubbleLoc);
+
+			// Player dodges sideways once they notice the paw coming
+			if (paw.isPounceMoving())
+			{
+				pounceMovingSeconds += kTickSeconds;
+			}
+			else
+			{
+				pounceMovingSeconds = 0.f;
+			}
+
+			if (pounceMovingSeconds > kReactionSeconds)
+			{
+				float away = bubbleLoc.X < paw.getLocation().X ? -1.f : 1.f;
+				bubbleLoc.X += away * kBubbleDodgeSpeed * kTickSeconds;
+			}
+			else
+			{
+				// Otherwise wander toward a random spot in the tank
+				PawVector toWaypoint = waypoint - bubbleLoc;
+				float step = kBubbleSpeed * kTickSeconds;
+
+				if (toWaypoint.Size() <= step)
+				{
+					waypoint = PawVector{ randomX(playerRng), 0.f, randomZ(playerRng) };
+				}
+				else
+				{
+					bubbleLoc = bubbleLoc + toWaypoint.GetSafeNormal() * step;
+				}
+			}
+
+			bubbleLoc.X = clampFloat(bubbleLoc.X, -kTankHalfWidth, kTankHalfWidth);
+
+			if ((paw.getLocation() - bubbleLoc).Size() < kCatchDistance)
+			{
+				return { true, seconds, paw.getPounceCount() };
+			}
+		}
+
+		return { false, kMaxGameSeconds, paw.getPounceCount() };
+	}
+}
+
+// ------------------------------------------------------------------- //
+//                                                                     //
+//   Monte Carlo sweep of difficulty settings with a headless player   //
+//                                                                     //
+// ------------------------------------------------------------------- //
+int main(int argc, char* argv[])
+{
+	int gamesPerSetting = argc > 1 ? std::atoi(argv[1]) : 1000;
+	std::uint32_t seed = argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 2025;
+
+	const std::vector<int> increaseSpeedsAfterN_Pounces{ 1, 2, 4 };
+	const std::vector<float> speedPounces{ 750.f, 1000.f, 1250.f };
+	const std::vector<std::pair<float, float>> delayRanges{ { 0.20f, 0.50f }, { 0.30f, 0.75f }, { 0.50f, 1.00f } };
+
+	std::printf("increaseAfterN,speedPounce,delayLow,delayHigh,catchRate,meanSeconds,meanPounces\n");
+
+	double simulatedSeconds = 0.0;
+	auto startTime = std::chrono::steady_clock::now();
+
+	for (int increaseAfterN : increaseSpeedsAfterN_Pounces)
+	{
+		for (float speedPounce : speedPounces)
+		{
+			for (const auto& [delayLow, delayHigh] : delayRanges)
+			{
+				PawSettings settings;
+				settings.increaseSpeedsAfterN_Pounces = increaseAfterN;
+				settings.speedPounce = speedPounce;
+				settings.delayPounceSecondsLow = delayLow;
+				settings.delayPounceSecondsHigh = delayHigh;
+
+				// Every setting plays the same seeds so results are comparable
+				SweepResult sweep;
+				for (int game = 0; game < gamesPerSetting; ++game)
+				{
+					GameResult result = playGame(settings, seed + static_cast<std::uint32_t>(game));
+
+					sweep.gamesCaught += result.caught ? 1 : 0;
+					sweep.totalSeconds += result.seconds;
+					sweep.totalPounces += result.pounces;
+				}
+				simulatedSeconds += sweep.totalSeconds;
+
+				double games = gamesPerSetting > 0 ? gamesPerSetting : 1;
+				std::printf("%d,%.0f,%.2f,%.2f,%.3f,%.2f,%.2f\n",
+					increaseAfterN, speedPounce, delayLow, delayHigh,
+					sweep.gamesCaught / games, sweep.totalSeconds / games, sweep.totalPounces / games);
+			}
+		}
+	}
+
+	double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	std::fprintf(stderr, "Simulated %.0f game seconds in %.2f s (%.0fx real time)\n",
+		simulatedSeconds, wallSeconds, wallSeconds > 0.0 ? simulatedSeconds / wallSeconds : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright © 2026 Lane Hale. All rights reserved.
+ *
+ * PawCrowdBenchmark.cpp
+ *
+ *  Created on: October 18, 2026
+ *      Author: Lane Hale
+ *
+ * Description: Benchmark of the per-frame cost of updating many paws,
+ *              one PawSimulation object per paw (the per-actor path,
+ *              without Unreal Engine's actor overhead) compared with one
+ *              PawCrowdSimulation batch update. It also checks that both
+ *              paths move every paw to exactly the same place, both for one
+ *              shared bubble and for paws playing independent games.
+ *
+ *              Usage: PawCrowdBenchmark [pawCount] [frames] [seed]
+ *
+ *     Purpose: Global Game Jam (GGJ) 2025
+ */
+
+#include "PawCrowdSimulation.h"
+#include "PawSimulation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+	// Set the global Tick value to 30 FPS, same as in Unreal Engine
+	constexpr float kTickSeconds = 1.f / 30.f;
+	constexpr float kPawStartZ = 600.f;
+
+	// Bubble moves slowly around the tank so pounces aim at different spots
+	PawVector bubbleLocationAt(int frame)
+	{
+		float seconds = frame * kTickSeconds;
+		return { 700.f * std::sin(seconds * 0.5f), 0.f, -100.f + 200.f * std::cos(seconds * 0.3f) };
+	}
+
+	// Same location, pitch and pounce count in both paths
+	bool samePaw(const PawSimulation& paw, const PawCrowdSimulation& crowd, std::size_t crowdPaw)
+	{
+		PawVector perPawLocation = paw.getLocation();
+		PawVector crowdLocation = crowd.getLocation(crowdPaw);
+		return perPawLocation.X == crowdLocation.X && perPawLocation.Y == crowdLocation.Y
+			&& perPawLocation.Z == crowdLocation.Z && paw.getPitch() == crowd.getPitch(crowdPaw)
+			&& paw.getPounceCount() == crowd.getPounceCount(crowdPaw);
+	}
+
+	// Every paw plays its own game: its own settings, seed and bubble.
+	// Returns the number of paws that do not match their own PawSimulation.
+	int independentGameMismatches(std::size_t pawCount, int frames, std::uint32_t seed)
+	{
+		std::vector<PawSettings> settings(3);
+		settings[1].leftRightWidth = 1500;
+		settings[1].speedPounce = 1250.f;
+		settings[1].increaseSpeedsAfterN_Pounces = 1;
+		settings[2].speedLeftRightPerTickLow = 8;
+		settings[2].speedLeftRightPerTickHigh = 20;
+		settings[2].LeftRightPawRotationPerTick = 0.75f;
+		settings[2].delayPounceSecondsLow = 0.5f;
+		settings[2].delayPounceSecondsHigh = 1.f;
+
+		std::vector<std::uint32_t> settingsIndex(pawCount);
+		std::vector<std::uint32_t> seeds(pawCount);
+		std::vector<PawSimulation> paws;
+		paws.reserve(pawCount);
+		for (std::size_t paw = 0; paw < pawCount; ++paw)
+		{
+			settingsIndex[paw] = static_cast<std::uint32_t>(paw % settings.size());
+			seeds[paw] = seed + 7 * static_cast<std::uint32_t>(paw);
+			paws.emplace_back(settings[settingsIndex[paw]], seeds[paw]);
+			paws.back().setLocation(PawVector{ 0.f, 0.f, kPawStartZ });
+		}
+
+		PawCrowdSimulation crowd(settings, settingsIndex, seeds);
+		std::vector<float> bubbleX(pawCount);
+		std::vector<float> bubbleY(pawCount);
+		std::vector<float> bubbleZ(pawCount);
+		for (std::size_t paw = 0; paw < pawCount; ++paw)
+		{
+			crowd.setLocation(paw, PawVector{ 0.f, 0.f, kPawStartZ });
+		}
+
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			// Each game's bubble is at a different point of its path
+			for (std::size_t paw = 0; paw < pawCount; ++paw)
+			{
+				PawVector bubbleLoc = bubbleLocationAt(frame + static_cast<int>(paw % 300));
+				paws[paw].tick(kTickSeconds, bubbleLoc);
+				bubbleX[paw] = bubbleLoc.X;
+				bubbleY[paw] = bubbleLoc.Y;
+				bubbleZ[paw] = bubbleLoc.Z;
+			}
+			crowd.tick(kTickSeconds, bubbleX, bubbleY, bubbleZ);
+		}
+
+		int mismatches = 0;
+		for (std::size_t paw = 0; paw < pawCount; ++paw)
+		{
+			mismatches += samePaw(paws[paw], crowd, paw) ? 0 : 1;
+		}
+		return mismatches;
+	}
+
+	double millisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::size_t pawCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+	int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+	std::uint32_t seed = argc > 3 ? static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 2025;
+
+	PawSettings settings;
+
+	// Per-actor path: one object per paw, each ticked on its own
+	std::vector<PawSimulation> paws;
+	paws.reserve(pawCount);
+	for (std::size_t paw = 0; paw < pawCount; ++paw)
+	{
+		paws.emplace_back(settings, seed + static_cast<std::uint32_t>(paw));
+		paws.back().setLocation(PawVector{ 0.f, 0.f, kPawStartZ });
+	}
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frames; ++frame)
+	{
+		PawVector bubbleLoc = bubbleLocationAt(frame);
+		for (PawSimulation& paw : paws)
+		{
+			paw.tick(kTickSeconds, bubbleLoc);
+		}
+	}
+	double perPawMilliseconds = millisecondsSince(startTime);
+
+	// Batch path: every paw in one structure of arrays
+	PawCrowdSimulation crowd(settings, pawCount, seed);
+	for (std::size_t paw = 0; paw < pawCount; ++paw)
+	{
+		crowd.setLocation(paw, PawVector{ 0.f, 0.f, kPawStartZ });
+	}
+
+	startTime = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frames; ++frame)
+	{
+		crowd.tick(kTickSeconds, bubbleLocationAt(frame));
+	}
+	double crowdMilliseconds = millisecondsSince(startTime);
+
+	// Both paths use the same random streams and the same arithmetic, so every
+	// paw must end up in exactly the same place with exactly the same pitch
+	float maxDifference = 0.f;
+	int locationMismatches = 0;
+	int pounceCountMismatches = 0;
+	for (std::size_t paw = 0; paw < pawCount; ++paw)
+	{
+		PawVector perPawLocation = paws[paw].getLocation();
+		PawVector crowdLocation = crowd.getLocation(paw);
+		maxDifference = std::max(maxDifference, (perPawLocation - crowdLocation).Size());
+		bool sameLocation = perPawLocation.X == crowdLocation.X && perPawLocation.Y == crowdLocation.Y
+			&& perPawLocation.Z == crowdLocation.Z && paws[paw].getPitch() == crowd.getPitch(paw);
+		locationMismatches += sameLocation ? 0 : 1;
+		pounceCountMismatches += paws[paw].getPounceCount() != crowd.getPounceCount(paw) ? 1 : 0;
+	}
+
+	double framesDivisor = frames > 0 ? frames : 1;
+	std::printf("%zu paws, %d frames\n", pawCount, frames);
+	std::printf("Per-paw objects: %.3f ms per frame\n", perPawMilliseconds / framesDivisor);
+	std::printf("Crowd (SoA):     %.3f ms per frame (%.1fx faster)\n",
+		crowdMilliseconds / framesDivisor, crowdMilliseconds > 0.0 ? perPawMilliseconds / crowdMilliseconds : 0.0);
+	std::printf("Max location difference: %g, location/pitch mismatches: %d, pounce count mismatches: %d\n",
+		maxDifference, locationMismatches, pounceCountMismatches);
+
+
+	int independentMismatches = independentGameMismatches(pawCount, frames, seed);
+	std::printf("Independent games (own settings, seed and bubble per paw) mismatches: %d\n", independentMismatches);
+
+	return (locationMismatches == 0 && pounceCountMismatches == 0 && independentMismatches == 0) ? 0 : 1;
+}